@@ -0,0 +1,365 @@
+/** ***************************************************************************
+ * @file
+ *
+ * @brief contains the source code for the flood fill library. The fill and
+ * the region query work on an image_view in place, nothing is copied.
+ *****************************************************************************/
+#include "floodFill.h"
+
+using namespace std;
+
+
+/** ***************************************************************************
+ * @author: Aidan Coopman
+ *
+ * @par Description:
+ * This function makes a view of an interleaved buffer. The layout decides
+ * where each channel sits inside a pixel and how many bytes a pixel uses.
+ *
+ * @param[in]      data - the first byte of row 0
+ * @param[in]      cols - the width of the image in pixels
+ * @param[in]      rows - the height of the image in pixels
+ * @param[in]      stride - the number of bytes between rows, negative if
+ *                          the rows go up through memory
+ * @param[in]      layout - the order of the channels
+ *
+ * @return returns the view of the buffer
+ *****************************************************************************/
+image_view make_view(pixel* data, int cols, int rows, int stride,
+    channel_layout layout)
+{
+    image_view view;
+
+    view.rows = rows;
+    view.cols = cols;
+    view.stride = stride;
+
+    //RGB and RGBA keep red first, BGR and BGRA keep blue first
+    if (layout == LAYOUT_RGB || layout == LAYOUT_RGBA)
+    {
+        view.red = data;
+        view.blue = data + 2;
+    }
+    else
+    {
+        view.red = data + 2;
+        view.blue = data;
+    }
+    view.green = data + 1;
+
+    //alpha adds one byte to each pixel
+    if (layout == LAYOUT_RGBA || layout == LAYOUT_BGRA)
+        view.step = 4;
+    else
+        view.step = 3;
+
+    return view;
+}
+
+
+/** ***************************************************************************
+ * @author: Aidan Coopman
+ *
+ * @par Description:
+ * This function makes a view of three separate channel planes with one
+ * byte per pixel.
+ *
+ * @param[in]      red - the first byte of the red plane
+ * @param[in]      green - the first byte of the green plane
+ * @param[in]      blue - the first byte of the blue plane
+ * @param[in]      cols - the width of the image in pixels
+ * @param[in]      rows - the height of the image in pixels
+ * @param[in]      stride - the number of bytes between rows of a plane,
+ *                          negative if the rows go up through memory
+ *
+ * @return returns the view of the planes
+ *****************************************************************************/
+image_view make_planar_view(pixel* red, pixel* green, pixel* blue,
+    int cols, int rows, int stride)
+{
+    image_view view;
+
+    view.red = red;
+    view.green = green;
+    view.blue = blue;
+    view.rows = rows;
+    view.cols = cols;
+    view.stride = stride;
+    view.step = 1;
+
+    return view;
+}
+
+
+/** ***************************************************************************
+ * @author: Aidan Coopman
+ *
+ * @par Description:
+ * This function finds the offset of the pixel at row, col from the start
+ * of each channel. The offset is signed so a negative stride walks up
+ * through memory for bottom up buffers.
+ *
+ * @param[in]      view - the image view
+ * @param[in]      row - the row of the pixel
+ * @param[in]      col - the column of the pixel
+ *
+ * @return returns the offset in bytes, negative if the stride is negative
+ *****************************************************************************/
+static ptrdiff_t offset(const image_view& view, int row, int col)
+{
+    return (ptrdiff_t)row * view.stride + (ptrdiff_t)col * view.step;
+}
+
+
+/** ***************************************************************************
+ * @author: Aidan Coopman
+ *
+ * @par Description:
+ * This function checks if the pixel at row, col is the color being queried.
+ * Pixels outside of the image never match.
+ *
+ * @param[in]      view - the image view
+ * @param[in]      row - the row to check
+ * @param[in]      col - the column to check
+ * @param[in]      red - the red value of the region
+ * @param[in]      green - the green value of the region
+ * @param[in]      blue - the blue value of the region
+ *
+ * @return returns true if the pixel is inside the image and the same color
+ *****************************************************************************/
+static bool same_color(const image_view& view, int row, int col,
+    pixel red, pixel green, pixel blue)
+{
+    ptrdiff_t at;
+
+    if (row < 0 || row >= view.rows || col < 0 || col >= view.cols)
+        return false;
+
+    at = offset(view, row, col);
+    return view.red[at] == red
+        && view.green[at] == green
+        && view.blue[at] == blue;
+}
+
+
+/** ***************************************************************************
+ * @author: Aidan Coopman
+ *
+ * @par Description:
+ * This function walks the region starting at row, col one horizontal span
+ * at a time. The start pixel is extended left and right as far as the color
+ * matches, then on_span is called with the row and the first and last
+ * column of the span. After that the rows above and below the span are
+ * scanned and one seed is pushed for each run of matching pixels.
+ *
+ * If visited is given it gets one bit set per walked pixel and the image is
+ * never changed. If visited is nullptr, on_span must recolor the span so
+ * walked pixels stop matching and are not walked again.
+ *
+ * The starting position must be inside the image.
+ *
+ * @param[in]      view - the image view
+ * @param[in]      row - the starting row
+ * @param[in]      col - the starting column
+ * @param[in,out]  visited - bitset of walked pixels, or nullptr
+ * @param[in]      on_span - called once for every span of the region
+ *
+ * @return returns the number of neighbors above and below the spans that
+ *         are not part of the region
+ *****************************************************************************/
+template <typename span_func>
+static int walk_region(const image_view& view, int row, int col,
+    vector<unsigned char>* visited, span_func on_span)
+{
+    vector<pair<int, int>> seeds;
+    pixel red, green, blue;
+    int left, right;
+    int edges = 0;
+    size_t index;
+    ptrdiff_t at;
+
+    //set the color of the region
+    at = offset(view, row, col);
+    red = view.red[at];
+    green = view.green[at];
+    blue = view.blue[at];
+
+    seeds.push_back(make_pair(row, col));
+    while (!seeds.empty())
+    {
+        row = seeds.back().first;
+        col = seeds.back().second;
+        seeds.pop_back();
+
+        //skip seeds whose span was already walked
+        if (!same_color(view, row, col, red, green, blue))
+            continue;
+        index = (size_t)row * view.cols + col;
+        if (visited != nullptr
+            && ((*visited)[index >> 3] & (1 << (index & 7))))
+            continue;
+
+        //extend the span left and right
+        left = col;
+        while (same_color(view, row, left - 1, red, green, blue))
+            left--;
+        right = col;
+        while (same_color(view, row, right + 1, red, green, blue))
+            right++;
+
+        //mark the span as visited
+        if (visited != nullptr)
+        {
+            for (int j = left; j <= right; j++)
+            {
+                index = (size_t)row * view.cols + j;
+                (*visited)[index >> 3] |= (1 << (index & 7));
+            }
+        }
+
+        on_span(row, left, right);
+
+        //scan the rows above and below the span
+        for (int next = row - 1; next <= row + 1; next += 2)
+        {
+            bool in_run = false;
+            for (int j = left; j <= right; j++)
+            {
+                if (!same_color(view, next, j, red, green, blue))
+                {
+                    edges++;
+                    in_run = false;
+                    continue;
+                }
+
+                //push one seed per unvisited run
+                index = (size_t)next * view.cols + j;
+                if (!in_run && (visited == nullptr
+                    || !((*visited)[index >> 3] & (1 << (index & 7)))))
+                    seeds.push_back(make_pair(next, j));
+                in_run = true;
+            }
+        }
+    }
+
+    return edges;
+}
+
+
+/** ***************************************************************************
+ * @author: Aidan Coopman
+ *
+ * @par Description:
+ * This function finds the region that a fill would cover starting at row,
+ * col and measures it. The image is never changed, instead walk_region
+ * records the visited pixels in a bitset with one bit per pixel.
+ *
+ * Every span adds its pixels to the area and its two ends to the perimeter.
+ * The neighbors above and below the spans that do not match make up the
+ * rest of the perimeter.
+ *
+ * @param[in]      view - the image view
+ * @param[in]      row - the starting row
+ * @param[in]      col - the starting column
+ * @param[out]     region - the measurements of the region
+ * @param[in]      want_mask - if true the visited bitset is returned as
+ *                             region.mask
+ * @param[in]      want_spans - if true every span is added to region.spans
+ *
+ * @return returns 0 if no error occured, returns 1 if the start is outside
+ *         of the image
+ *****************************************************************************/
+int query_view(const image_view& view, int row, int col, region_info& region,
+    bool want_mask, bool want_spans)
+{
+    vector<unsigned char> visited;
+    int edges;
+
+    //reset the result
+    region.area = 0;
+    region.perimeter = 0;
+    region.min_row = row;
+    region.max_row = row;
+    region.min_col = col;
+    region.max_col = col;
+    region.mask.clear();
+    region.spans.clear();
+
+    //make sure the starting position is inside the image
+    if (row < 0 || row >= view.rows || col < 0 || col >= view.cols)
+        return 1;
+
+    //one bit per pixel, all unvisited
+    visited.assign(((size_t)view.rows * view.cols + 7) / 8, 0);
+
+    edges = walk_region(view, row, col, &visited,
+        [&](int span_row, int left, int right)
+        {
+            //the ends of a span are always edges
+            region.area += right - left + 1;
+            region.perimeter += 2;
+            region.min_row = min(region.min_row, span_row);
+            region.max_row = max(region.max_row, span_row);
+            region.min_col = min(region.min_col, left);
+            region.max_col = max(region.max_col, right);
+            if (want_spans)
+                region.spans.push_back({ span_row, left, right });
+        });
+    region.perimeter += edges;
+
+    //hand the bitset back as the mask if it was requested
+    if (want_mask)
+        region.mask.swap(visited);
+
+    return 0;
+}
+
+
+/** ***************************************************************************
+ * @author: Aidan Coopman
+ *
+ * @par Description:
+ * This function fills the region at row, col with the inputed color. Each
+ * span is painted in the caller's buffer as soon as walk_region finds it.
+ * Painted pixels no longer match the region color so no visited bitset or
+ * span list is needed. If the region is already the inputed color nothing
+ * is changed.
+ *
+ * @param[in]      view - the image view, its pixels are changed in place
+ * @param[in]      row - the starting row
+ * @param[in]      col - the starting column
+ * @param[in]      red - the red value that will be filled
+ * @param[in]      green - the green value that will be filled
+ * @param[in]      blue - the blue value that will be filled
+ *
+ * @return returns 0 if the region was filled, returns 1 if the start is
+ *         outside of the image, returns 2 if the region is already the
+ *         inputed color and nothing was changed
+ *****************************************************************************/
+int fill_view(const image_view& view, int row, int col,
+    pixel red, pixel green, pixel blue)
+{
+    //make sure the starting position is inside the image
+    if (row < 0 || row >= view.rows || col < 0 || col >= view.cols)
+        return 1;
+
+    //nothing to do if the region is already the new color
+    if (same_color(view, row, col, red, green, blue))
+        return 2;
+
+    //replace the color on every span as it is found
+    walk_region(view, row, col, nullptr,
+        [&](int span_row, int left, int right)
+        {
+            ptrdiff_t at = offset(view, span_row, left);
+            for (int j = left; j <= right; j++)
+            {
+                view.red[at] = red;
+                view.green[at] = green;
+                view.blue[at] = blue;
+                at += view.step;
+            }
+        });
+
+    return 0;
+}
@@ -0,0 +1,113 @@
+/** ***************************************************************************
+ * @file
+ *
+ * @brief header file for the flood fill library. Contains the image view
+ * and the fill and query functions that work on it.
+ *****************************************************************************/
+
+#include <cstddef>
+#include <vector>
+
+#ifndef  __FLOODFILL__H__
+#define  __FLOODFILL__H__
+
+/** ***************************************************************************
+* typedef named pixel, unsigned char
+******************************************************************************/
+typedef unsigned char pixel;
+
+/** ***************************************************************************
+* enum named channel_layout. Order of the channels in an interleaved buffer.
+******************************************************************************/
+enum channel_layout
+{
+    LAYOUT_RGB,
+    LAYOUT_BGR,
+    LAYOUT_RGBA,
+    LAYOUT_BGRA
+};
+
+/** ***************************************************************************
+* struct named image_view. Points into pixel memory owned by the caller, it
+* never allocates or frees anything. Each channel has its own pointer to
+* the pixel at row 0, column 0 so both interleaved and planar buffers work.
+* stride is the number of bytes between rows, step is the number of bytes
+* between pixels on a row. stride may be negative for bottom up buffers,
+* in that case the channel pointers point at the last row in memory.
+******************************************************************************/
+struct image_view
+{
+    pixel* red;
+    pixel* green;
+    pixel* blue;
+    int    rows;
+    int    cols;
+    int    stride;
+    int    step;
+};
+
+/** ***************************************************************************
+* struct named region_span. One horizontal run of a region, from col_start
+* to col_end inclusive on a single row.
+******************************************************************************/
+struct region_span
+{
+    int row;
+    int col_start;
+    int col_end;
+};
+
+/** ***************************************************************************
+* struct named region_info. Result of a region query. Contains the pixel
+* count, bounding box and perimeter of the region, and optionally a bit
+* packed mask (bit row * cols + col, low bit first) and the list of spans.
+******************************************************************************/
+struct region_info
+{
+    // measurements of the region
+    int area;
+    int min_row;
+    int min_col;
+    int max_row;
+    int max_col;
+    int perimeter;
+
+    // optional outputs, left empty if not requested
+    std::vector<unsigned char> mask;
+    std::vector<region_span>   spans;
+};
+
+
+//Views************************************************************************
+
+/** ***************************************************************************
+* makes a view of an interleaved buffer such as RGB, BGR, RGBA or BGRA
+******************************************************************************/
+image_view make_view(pixel* data, int cols, int rows, int stride,
+    channel_layout layout);
+
+/** ***************************************************************************
+* makes a view of three separate channel planes that share a row stride
+******************************************************************************/
+image_view make_planar_view(pixel* red, pixel* green, pixel* blue,
+    int cols, int rows, int stride);
+
+
+//Region Operations************************************************************
+
+/** ***************************************************************************
+* finds the region a fill would cover without changing the image
+* returns 0 if no error occurred, returns 1 if the start is out of bounds
+******************************************************************************/
+int query_view(const image_view& view, int row, int col, region_info& region,
+    bool want_mask = false, bool want_spans = false);
+
+/** ***************************************************************************
+* fills the region at row, col with the inputed color in place
+* returns 0 if no error occurred, returns 1 if the start is out of bounds,
+* returns 2 if the region is already the inputed color
+******************************************************************************/
+int fill_view(const image_view& view, int row, int col,
+    pixel red, pixel green, pixel blue);
+
+#endif
@@ -11,6 +11,8 @@
  *
  * @par Description:
  * This function allocates memory for an array of any specified size.
+ * The pixels are stored in one block, row after row, with each row
+ * pointer pointing into it.
  *
  * @param[in]      rows - rows that is requested to be allocated
  * @param[in]      cols - columns that is requested to be allocated
@@ -26,19 +28,20 @@ pixel** alloc2d(int rows, int cols)
     array2D = new pixel * [rows];
 
     //check to make sure array is not null
-    if (array2D == nullptr)
+    if (array2D == nullptr || rows <= 0)
     {
-        return nullptr;
+        return array2D;
     }
 
-    //allocate memory for the array until rows is reached
-    for (int i = 0; i < rows; i++)
-    {
-        array2D[i] = nullptr;
-        array2D[i] = new pixel[cols];
-        if (array2D[i] == nullptr)
-            return nullptr;
-    }
+    //allocate all of the pixels in one block so the rows are contiguous
+    array2D[0] = nullptr;
+    array2D[0] = new pixel[(size_t)rows * cols];
+    if (array2D[0] == nullptr)
+        return nullptr;
+
+    //point each row into the block
+    for (int i = 1; i < rows; i++)
+        array2D[i] = array2D[0] + (size_t)i * cols;
 
     //return the allocated array
     return array2D;
@@ -50,8 +53,8 @@ pixel** alloc2d(int rows, int cols)
  *
  * @par Description:
  * This function frees up the memory created by dynamicly allocated memory.
- * Starts at the ptr, deleting and traversing throught the array until it
- * reaches the end
+ * The pixels are one block starting at the first row, so that block is
+ * deleted and then the array of row pointers is deleted
  * 
  * @param[in]      ptr - ptr to the start of the array
  * @param[in]      rows - rows that is requested to be allocated
@@ -62,14 +65,11 @@ void free2d(pixel**& ptr, int rows)
     if (ptr == nullptr)
         return;
 
-    //go throught the rows deleting as it goes until EOF
-    for (int i = 0; i < rows; i++)
-    {
-        if (ptr[i] != nullptr)
-            delete[] ptr[i];
-    }
+    //delete the block of pixels that all the rows point into
+    if (rows > 0 && ptr[0] != nullptr)
+        delete[] ptr[0];
 
-    //if the ptr is null ptr, delete the ptr
-    if (ptr != nullptr)
-        delete[] ptr;
+    //delete the row pointers
+    delete[] ptr;
+    ptr = nullptr;
 }
\ No newline at end of file
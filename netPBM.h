@@ -10,16 +10,12 @@
 #include <sstream>
 #include <algorithm>
 #include <iomanip>
+#include "floodFill.h"
 
 using namespace std; 
 #ifndef  __NETPBM__H__ 
 #define  __NETPBM__H__ 
 
-/** ***************************************************************************
-* typedef named pixel, unsigned char
-******************************************************************************/
-typedef unsigned char pixel; 
-
 /** ***************************************************************************
 * struct named image. Main struct used in the program.
 * Contains image rows and columns, 2D arrays for RGB, comment line,
@@ -45,16 +41,23 @@ struct image
 //Image Operations*************************************************************
 
 /** ***************************************************************************
-* goes to the starting point and gets the color, then calls the fill function
+* fills the region at the starting point by calling fill_view in the library
+* and reports when the region is already the inputed color
+* returns 1 if the start is out of bounds, returns 2 if nothing was changed
 ******************************************************************************/
-void fill_region(image& info, int row, int col, 
+int fill_region(image& info, int row, int col, 
     pixel red, pixel green, pixel blue);
 
 /** ***************************************************************************
-* fills the selected area with the inputed color
+* makes a view of the rgb planes of the image for the flood fill library
+******************************************************************************/
+image_view get_view(image& info);
+
+/** ***************************************************************************
+* parses a ppm file and prints the region at row, col without filling it
+* returns 0 if no error occurred, returns 1 if an error occured
 ******************************************************************************/
-void fill(image& info, int row, int col, pixel red_current, pixel green_current,
-    pixel blue_current, pixel new_red, pixel new_green, pixel new_blue);
+int query_main(string input_name, int row, int col);
 
 
 //Memory***********************************************************************
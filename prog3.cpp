@@ -48,17 +48,22 @@ using namespace std;
   * BINARY it will read the pixel values into the struct as well.
   *
   * After the image is read in it will be closed and reopened as 
-  * a file out so it can be written to. It will then run the get_color
-  * function to get the starting color that will be replaced, then it
-  * will call the fill function and it will fill up the specified area
+  * a file out so it can be written to. It will then run the fill_region
+  * function, which calls fill_view in the flood fill library to fill up
+  * the specified area. If the starting color is already the inputted
+  * color nothing is changed, and if the starting position is outside of
+  * the image an error is printed and the file is not written.
   * 
-  * The program will return 0.
+  * The program will return 0, or 1 if an error occurred.
 
   *
   * @section compile_section Compiling and Usage
   *
   * @par Compiling Instructions:
-  *      Set the stack reserve and commit size to 4 billion
+  *      Build the floodFill static library project first, prog3 links
+  *      against it. The fill and region query live in the library and work
+  *      on an image_view so other programs can use them on their own
+  *      RGB, BGR, RGBA or BGRA buffers without copying.
   *
   * @par Usage
     @verbatim
@@ -69,6 +74,10 @@ using namespace std;
         green  - green value that will be filled (0-255)
         blue   - blue value that will be filled (0-255)
 
+    c:\> prog3.exe inputFile.ppm row column
+        prints the area, bounding box and perimeter of the region
+        at row, column without changing the file
+
     @endverbatim
   *
   * @par Modifications and Development Timeline:
@@ -94,13 +103,18 @@ int main(int argc, char** argv)
     pixel  blue_value;
 
     //check to make sure there is enough arguments
-    if (argc != 7)
+    if (argc != 7 && argc != 4)
     {
         cout << "Usage: prog3.exe input_image.ppm [row] [column] ";
         cout << "[red value] [green value] [blue value]" << endl;
+        cout << "       prog3.exe input_image.ppm [row] [column]" << endl;
         return 1;
     }
 
+    //only a position was given, report the region without filling it
+    if (argc == 4)
+        return query_main(argv[1], stoi(argv[2]), stoi(argv[3]));
+
     //copy the data from command line into variables
     input_name   = argv[1];
     starting_row = stoi(argv[2]);
@@ -119,9 +133,16 @@ int main(int argc, char** argv)
     }
 
     // Fill the region the user requested
-    // starting row and col are within boundaries and are not checked
-    fill_region(info, starting_row, starting_col, 
-        red_value, green_value, blue_value);
+    // returns 1 if the starting row and col are outside of the image
+    if (fill_region(info, starting_row, starting_col, 
+        red_value, green_value, blue_value) == 1)
+    {
+        cout << "Starting position is outside of the image\n";
+        free2d(info.red, info.rows);
+        free2d(info.green, info.rows);
+        free2d(info.blue, info.rows);
+        return 1;
+    }
 
     // Replace the input ppm file with the new image with filled region
     // returns 0 if no error occurred otherwise returns 1
@@ -141,11 +162,60 @@ int main(int argc, char** argv)
  * @author: Aidan Coopman
  *
  * @par Description:
- * This function gets the color at the starting location inputted by the user.
- * It does this by finding each pixel value at the starting point. Then
- * it compares it to the inputted color and if they are the same it exits
- * the progam, otherwise if the colors are different it will call the 
- * fill function
+ * This function reports the region that a fill would cover. It parses the
+ * image, queries the region at row, col and prints its area, bounding box
+ * and perimeter. The image is never written back.
+ *
+ * @param[in]      input_name - the ppm file to read
+ * @param[in]      row - the starting row
+ * @param[in]      col - the starting column
+ *
+ * @return returns 0 if no error occured, returns 1 if an error occured
+ *****************************************************************************/
+int query_main(string input_name, int row, int col)
+{
+    image info;
+    region_info region;
+    int result;
+
+    // parse the input file
+    if (parse_ppm(input_name, info))
+    {
+        cout << "An error occurred while parsing ppm file\n";
+        return 1;
+    }
+
+    // find the region, nothing in info is changed
+    result = query_view(get_view(info), row, col, region);
+
+    //free the memory, write_ppm is skipped so it is done here
+    free2d(info.red, info.rows);
+    free2d(info.green, info.rows);
+    free2d(info.blue, info.rows);
+
+    if (result)
+    {
+        cout << "Starting position is outside of the image\n";
+        return 1;
+    }
+
+    cout << "Area: " << region.area << endl;
+    cout << "Bounding box: rows " << region.min_row << "-" << region.max_row;
+    cout << ", columns " << region.min_col << "-" << region.max_col << endl;
+    cout << "Perimeter: " << region.perimeter << endl;
+
+    return 0;
+}
+
+
+/** ***************************************************************************
+ * @author: Aidan Coopman
+ *
+ * @par Description:
+ * This function fills the region at the starting location inputted by the
+ * user by calling the fill_view function from the flood fill library. If
+ * the starting color is already the inputted color nothing is changed and
+ * a message is printed
  *
  *
  *
@@ -155,31 +225,25 @@ int main(int argc, char** argv)
  * @param[in]      red - the red value that the user inputted
  * @param[in]      green - the green value that the user inputted
  * @param[in]      blue - the blue value that the user inputted
+ *
+ * @return returns the result of fill_view, 0 if the region was filled,
+ *         1 if the start is outside of the image, 2 if nothing was changed
  *****************************************************************************/
-void fill_region(image& info, int row, int col, 
+int fill_region(image& info, int row, int col, 
     pixel red, pixel green, pixel blue)
 {
-    //set the current colors
-    pixel red_current = info.red[row][col];
-    pixel green_current = info.green[row][col];
-    pixel blue_current = info.blue[row][col];
-
-    //check to make sure starting position color 
-    //is not the same as the inputted color
-    //if it is the same color, do nothing
-    if (info.red[row][col] != red
-        || info.green[row][col] != green
-        || info.blue[row][col] != blue)
-    {
-        fill(info, row, col, red_current, green_current, 
-            blue_current, red, green, blue);
-    }
-    else
+    int result;
+
+    //fill_view does nothing if the starting position color
+    //is the same as the inputted color and returns 2
+    result = fill_view(get_view(info), row, col, red, green, blue);
+    if (result == 2)
     {
         cout << "Starting position color is the same color ";
         cout << "as inputed color so nothing will be done\n";
     }
 
+    return result;
 }
 
 
@@ -187,49 +251,16 @@ void fill_region(image& info, int row, int col,
  * @author: Aidan Coopman
  *
  * @par Description:
- * This function fills an area of the same color. It does this by recusivly
- * calling itslf and chnaging the pixels until it hits a edge, or it finds 
- * a pixel that is of a different color.
- * 
- *
+ * This function makes a view of the rgb planes so the flood fill library
+ * can work on the image in place. alloc2d stores each plane in one block
+ * so a plane is cols bytes per row with one byte per pixel.
  *
+ * @param[in]      info - the main image struct
  *
- * @param[in,out]      info - the main image struct
- * @param[in]      row - the starting row
- * @param[in]      col - the starting column
- * @param[in]      red_current - the red value that is being replaced
- * @param[in]      green_current - the green value that is being replaced
- * @param[in]      blue_current - the blue value that is being replaced
- * @param[in]      new_red - the red value that the user inputted
- * @param[in]      new_green - the green value that the user inputted
- * @param[in]      new_blue - the blue value that the user inputted
+ * @return returns the view of the image
  *****************************************************************************/
-void fill(image& info, int row, int col, pixel red_current, 
-    pixel green_current, pixel blue_current, pixel new_red, 
-    pixel new_green, pixel new_blue)
+image_view get_view(image& info)
 {
-    //make sure it stays in boundries, if it hits an edge then return
-    if (row < 0 || row >= info.rows || col < 0 || col >= info.cols)
-        return;
-
-    //if it hits a different color then return
-    if (info.red[row][col] != red_current 
-        || info.green[row][col] != green_current 
-        || info.blue[row][col] != blue_current)
-        return;
-
-    //replace color at row, col
-    info.red[row][col] = new_red;
-    info.green[row][col] = new_green;
-    info.blue[row][col] = new_blue;
-
-    //recursivly call in all directions, row+1, row-1, col+1, col-1
-    fill(info, row + 1, col, red_current, green_current, 
-        blue_current, new_red, new_green, new_blue);
-    fill(info, row - 1, col, red_current, green_current, 
-        blue_current, new_red, new_green, new_blue);
-    fill(info, row, col + 1, red_current, green_current, 
-        blue_current, new_red, new_green, new_blue);
-    fill(info, row, col - 1, red_current, green_current, 
-        blue_current, new_red, new_green, new_blue);
+    return make_planar_view(info.red[0], info.green[0], info.blue[0],
+        info.cols, info.rows, info.cols);
 }